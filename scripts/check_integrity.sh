@@ -36,6 +36,12 @@ root -q /tmp/compiling.C
 ls -lh cmsstyle_C.so
 \rm -rf cmsstyle_C* &> /dev/null
 cd ..
+
+# Trying to build the library with its dictionary
+\rm -rf /tmp/build_cmsstyle$$ &> /dev/null
+cmake -S . -B /tmp/build_cmsstyle$$ && cmake --build /tmp/build_cmsstyle$$ -j 4
+ls -lh /tmp/build_cmsstyle$$/lib/
+\rm -rf /tmp/build_cmsstyle$$ &> /dev/null
 echo
 EOF
 chmod a+x tmp$$_integrity_el9.sh
@@ -0,0 +1,214 @@
+#
+# This python macro measures the time (and memory) used by the main
+# methods of the CMSStyle in its python implementation. It uses the same
+# scenarios and output format as tests/benchmark.C (C++ implementation), so
+# both may be compared.
+#
+# To run it just execute:
+#         $ source scripts/setup_cmstyle   # From the CMSStyle-package top directory
+#         $ python3 benchmark.py [--output benchmark_py.json] [--repeat 5] [--quick]
+#
+# Written by O. Gonzalez (2026_10_16)
+#
+
+import argparse
+import json
+import math
+import os
+import time
+
+import ROOT
+
+import cmsstyle
+
+
+# # # #
+def current_rss():
+    """Return the current resident memory of the process (in kB).
+
+    The increase around each scenario is reported, as the peak of the process
+    would be the one of the largest scenario for all the following ones.
+    """
+    info = ROOT.ProcInfo_t()
+    ROOT.gSystem.GetProcInfo(info)
+    return info.fMemResident
+
+
+# # # #
+def measure(results, bench, nobjects, nbins, fmt, nrepeat, func):
+    """Run the function nrepeat times and store the measurement per call.
+
+    Args:
+        results (list): list where the measurement is appended.
+        bench (str): name of the benchmark.
+        nobjects (int): number of objects used in the benchmark.
+        nbins (int): number of bins of the (each) histogram.
+        fmt (str): output format (if any).
+        nrepeat (int): number of repetitions.
+        func (callable): method to be measured.
+    """
+    rss0 = current_rss()
+    real0 = time.perf_counter()
+    cpu0 = time.process_time()
+    for _ in range(nrepeat):
+        func()
+    real_s = (time.perf_counter() - real0) / nrepeat
+    cpu_s = (time.process_time() - cpu0) / nrepeat
+
+    results.append(
+        {
+            "impl": "python",
+            "bench": bench,
+            "nobjects": nobjects,
+            "nbins": nbins,
+            "format": fmt,
+            "repeat": nrepeat,
+            "real_s": real_s,
+            "cpu_s": cpu_s,
+            "rss_increase_kb": current_rss() - rss0,
+        }
+    )
+    print(f"  {bench} nobjects={nobjects} nbins={nbins} {fmt}: {1000*real_s} ms/call")
+
+
+# # # #
+def build_histos(nobjects, nbins):
+    """Build the histograms to be stacked."""
+    histos = []
+    for i in range(nobjects):
+        h = ROOT.TH1F(f"bench_{nobjects}_{i}", "bench", nbins, 0.0, 10.0)
+        h.SetDirectory(ROOT.nullptr)
+        for j in range(1, nbins + 1):
+            h.SetBinContent(j, (1 + i % 5) * math.exp(-10.0 * j / (nbins * (1 + i % 3))))
+        histos.append(h)
+    return histos
+
+
+# # # #
+def build_histo2D(nbins):
+    """Build a 2-D histogram with two gaussian peaks."""
+    h = ROOT.TH2F(f"bench2D_{nbins}", "bench2D", nbins, 0.0, 60.0, nbins, 0.0, 60.0)
+    h.SetDirectory(ROOT.nullptr)
+    for i in range(1, nbins + 1):
+        x = 60.0 * (i - 0.5) / nbins
+        for j in range(1, nbins + 1):
+            y = 60.0 * (j - 0.5) / nbins
+            h.SetBinContent(
+                i,
+                j,
+                10 * math.exp((30 - x) * (30 - x) / -25.0) * math.exp((20 - y) * (20 - y) / -20.0)
+                + 15 * math.exp((45 - x) * (45 - x) / -45.0) * math.exp((40 - y) * (40 - y) / -50.0),
+            )
+    return h
+
+
+# # # #
+def benchmark(outfile="benchmark_py.json", nrepeat=5, quick=False):
+    """Run all the benchmarks and write the results in JSON format.
+
+    Args:
+        outfile (str, optional): name of the output (JSON) file.
+        nrepeat (int, optional): number of repetitions for each scenario.
+        quick (bool, optional): whether to use a reduced set of scenarios.
+    """
+    ROOT.gROOT.SetBatch(ROOT.kTRUE)
+    cmsstyle.setCMSStyle()
+
+    outdir = "benchmark_output"
+    os.makedirs(outdir, exist_ok=True)
+
+    nobjects_list = [1, 5, 20, 100]
+    nbins_list = [10, 100, 1000]
+    nbins2D_list = [25, 100, 500]
+    formats = ["pdf", "png", "svg", "eps", "root", "C"]
+    if quick:
+        nobjects_list = [1, 20]
+        nbins_list = [100]
+        nbins2D_list = [100]
+        formats = ["pdf", "png"]
+
+    results = []
+    print("Running the python benchmarks of CMSStyle")
+
+    # The canvas (including the CMS_lumi call)
+    def bench_canvas():
+        c = cmsstyle.cmsCanvas("bench_canvas", 0.0, 10.0, 0.0, 10.0, "X var", "Y var")
+        c.Close()
+
+    measure(results, "cmsCanvas", 0, 0, "", nrepeat, bench_canvas)
+
+    # The CMS_lumi alone (in an existing canvas)
+    c = cmsstyle.cmsCanvas("bench_lumi", 0.0, 10.0, 0.0, 10.0, "X var", "Y var")
+    measure(results, "CMS_lumi", 0, 0, "", nrepeat, lambda: cmsstyle.CMS_lumi(c))
+    c.Close()
+
+    # The stacks, for different number of objects and bins
+    for nobjects in nobjects_list:
+        for nbins in nbins_list:
+            histos = build_histos(nobjects, nbins)
+            objs = [(xhst, xhst.GetName(), "f") for xhst in histos]
+
+            def bench_stack():
+                c = cmsstyle.cmsCanvas("bench_stack", 0.0, 10.0, 0.0, 100.0, "X var", "Y var")
+                leg = cmsstyle.cmsLeg(0.55, 0.65, 0.9, 0.9)
+                cmsstyle.buildAndDrawTHStack(objs, leg)
+                cmsstyle.UpdatePad(c)
+                c.Close()
+
+            measure(results, "buildAndDrawTHStack", nobjects, nbins, "", nrepeat, bench_stack)
+
+    # The 2-D path with the palette
+    for nbins in nbins2D_list:
+        h = build_histo2D(nbins)
+
+        def bench_2D():
+            c = cmsstyle.cmsCanvas(
+                "bench_2D", 0.0, 60.0, 0.0, 60.0, "X var", "Y var", with_z_axis=True
+            )
+            cmsstyle.SetAlternative2DColor(h)
+            cmsstyle.cmsObjectDraw(h, "COLZ")
+            cmsstyle.UpdatePalettePosition(h, c)
+            cmsstyle.UpdatePad(c)
+            c.Close()
+
+        measure(results, "palette2D", 1, nbins * nbins, "", nrepeat, bench_2D)
+
+    # Saving in the different formats (a stack plot and a 2-D plot)
+    histos = build_histos(5, 100)
+    h2D = build_histo2D(100)
+
+    for fmt in formats:
+
+        def bench_save():
+            c = cmsstyle.cmsCanvas("bench_save", 0.0, 10.0, 0.0, 100.0, "X var", "Y var")
+            hs = cmsstyle.buildTHStack(histos)
+            cmsstyle.cmsObjectDraw(hs, "")
+            cmsstyle.SaveCanvas(c, os.path.join(outdir, "bench_stack_py." + fmt))
+
+        measure(results, "SaveCanvas", 5, 100, fmt, nrepeat, bench_save)
+
+        def bench_save2D():
+            c = cmsstyle.cmsCanvas(
+                "bench_save2D", 0.0, 60.0, 0.0, 60.0, "X var", "Y var", with_z_axis=True
+            )
+            cmsstyle.SetAlternative2DColor(h2D)
+            cmsstyle.cmsObjectDraw(h2D, "COLZ")
+            cmsstyle.UpdatePalettePosition(h2D, c)
+            cmsstyle.SaveCanvas(c, os.path.join(outdir, "bench_2D_py." + fmt))
+
+        measure(results, "SaveCanvas2D", 1, 100 * 100, fmt, nrepeat, bench_save2D)
+
+    with open(outfile, "w") as out:
+        json.dump(results, out, indent=2)
+
+    print(f"Finished: produced file {outfile}")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Benchmarks for the python implementation of CMSStyle")
+    parser.add_argument("--output", default="benchmark_py.json", help="Output file (JSON format)")
+    parser.add_argument("--repeat", type=int, default=5, help="Number of repetitions for each scenario")
+    parser.add_argument("--quick", action="store_true", help="Use a reduced set of scenarios")
+    args = parser.parse_args()
+
+    benchmark(args.output, args.repeat, args.quick)
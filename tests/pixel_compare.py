@@ -0,0 +1,297 @@
+#
+# This python script performs a pixel-by-pixel comparison of plots, to detect
+# changes in the produced plots (e.g. with respect to the reference PDF files
+# in tests/pdfs and tests/pdfs_palette, or between the C++ and the python
+# implementations).
+#
+# It runs offline and does not need ROOT for the comparison itself: the PNG
+# and PPM files are read directly, and the PDF files are rasterized with
+# pdftoppm (poppler) or ImageMagick, the first of them available.
+#
+# Examples of use (from the tests directory, after source scripts/setup_cmstyle):
+#
+#     $ python3 pixel_compare.py file1.pdf file2.pdf
+#     $ python3 pixel_compare.py --references          # Runs example.py and example_palette.py
+#     $ python3 pixel_compare.py --cpp-python .        # Compares test_*_C.png with test_*.png
+#
+# The result is written in JSON format (--output) and the script returns a
+# non-zero code if any of the comparisons is above the threshold.
+#
+# Written by O. Gonzalez (2026_10_16)
+#
+
+import argparse
+import glob
+import json
+import math
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+
+TESTS_DIR = os.path.dirname(os.path.abspath(__file__))
+
+
+# # # #
+def read_ppm(path):
+    """Read a binary PPM (P6) file.
+
+    Args:
+        path (str): name of the file.
+
+    Returns:
+        tuple: (width, height, bytes with the RGB values)
+    """
+    with open(path, "rb") as fin:
+        data = fin.read()
+
+    # Header: magic, width, height and maxval (with possible comments)
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos : pos + 1].isspace():
+            pos += 1
+        if data[pos : pos + 1] == b"#":
+            pos = data.index(b"\n", pos) + 1
+            continue
+        end = pos
+        while not data[end : end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    pos += 1  # Single whitespace after maxval
+
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        raise ValueError(f"Unsupported PPM file (only 8-bit P6): {path}")
+
+    width, height = int(fields[1]), int(fields[2])
+    return width, height, data[pos : pos + 3 * width * height]
+
+
+# # # #
+def read_png(path):
+    """Read a (non-interlaced, 8-bit) PNG file as produced by ROOT.
+
+    Args:
+        path (str): name of the file.
+
+    Returns:
+        tuple: (width, height, bytes with the RGB values)
+    """
+    with open(path, "rb") as fin:
+        data = fin.read()
+
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"Not a PNG file: {path}")
+
+    pos = 8
+    idat = b""
+    palette = None
+    while pos < len(data):
+        (length,) = struct.unpack(">I", data[pos : pos + 4])
+        ctype = data[pos + 4 : pos + 8]
+        chunk = data[pos + 8 : pos + 8 + length]
+        pos += 12 + length
+
+        if ctype == b"IHDR":
+            width, height, depth, colortype, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif ctype == b"PLTE":
+            palette = chunk
+        elif ctype == b"IDAT":
+            idat += chunk
+        elif ctype == b"IEND":
+            break
+
+    if depth != 8 or interlace != 0:
+        raise ValueError(f"Unsupported PNG file (only 8-bit non-interlaced): {path}")
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[colortype]
+    stride = width * channels
+    raw = zlib.decompress(idat)
+
+    # Undoing the filters, line by line
+    pixels = bytearray(height * stride)
+    prev = bytearray(stride)
+    ipos = 0
+    for row in range(height):
+        ftype = raw[ipos]
+        line = bytearray(raw[ipos + 1 : ipos + 1 + stride])
+        ipos += 1 + stride
+
+        for i in range(stride):
+            left = line[i - channels] if i >= channels else 0
+            up = prev[i]
+            if ftype == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((left + up) >> 1)) & 0xFF
+            elif ftype == 4:
+                upleft = prev[i - channels] if i >= channels else 0
+                p = left + up - upleft
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - upleft)
+                pred = left if (pa <= pb and pa <= pc) else (up if pb <= pc else upleft)
+                line[i] = (line[i] + pred) & 0xFF
+
+        pixels[row * stride : (row + 1) * stride] = line
+        prev = line
+
+    # Converting to RGB
+    if colortype == 2:
+        rgb = bytes(pixels)
+    elif colortype == 6:
+        rgb = bytes(b for i, b in enumerate(pixels) if i % 4 != 3)
+    elif colortype == 3:
+        rgb = b"".join(palette[3 * x : 3 * x + 3] for x in pixels)
+    else:  # Gray (with or without alpha)
+        rgb = bytes(b for x in pixels[::channels] for b in (x, x, x))
+
+    return width, height, rgb
+
+
+# # # #
+def rasterize_pdf(path, dpi, workdir):
+    """Convert the (first page of the) PDF file into a PPM file.
+
+    Args:
+        path (str): name of the PDF file.
+        dpi (int): resolution for the conversion.
+        workdir (str): directory where to put the PPM file.
+
+    Returns:
+        str: name of the produced PPM file.
+    """
+    base = os.path.join(workdir, os.path.basename(path) + f".{abs(hash(path))}")
+
+    if shutil.which("pdftoppm"):
+        subprocess.run(["pdftoppm", "-r", str(dpi), "-singlefile", "-f", "1", "-l", "1", path, base], check=True)
+        return base + ".ppm"
+
+    magick = shutil.which("magick") or shutil.which("convert")
+    if magick:
+        subprocess.run([magick, "-density", str(dpi), path + "[0]", "-background", "white",
+                        "-flatten", "-depth", "8", base + ".ppm"], check=True)
+        return base + ".ppm"
+
+    raise RuntimeError("Neither pdftoppm nor ImageMagick found to rasterize the PDF files")
+
+
+# # # #
+def read_image(path, dpi, workdir):
+    """Read an image file (PDF, PNG or PPM) as RGB values."""
+    ext = os.path.splitext(path)[1].lower()
+    if ext == ".pdf":
+        return read_ppm(rasterize_pdf(path, dpi, workdir))
+    if ext == ".png":
+        return read_png(path)
+    if ext in (".ppm", ".pnm"):
+        return read_ppm(path)
+    raise ValueError(f"Unsupported file type for the comparison: {path}")
+
+
+# # # #
+def compare(path1, path2, dpi=72, workdir=None, tolerance=8):
+    """Compare two plots pixel by pixel.
+
+    Args:
+        path1 (str): name of the first file (PDF, PNG or PPM).
+        path2 (str): name of the second file.
+        dpi (int, optional): resolution used for the PDF files.
+        workdir (str, optional): directory for the temporary files.
+        tolerance (int, optional): difference (0-255) in any channel to count a pixel as different.
+
+    Returns:
+        dict: with the RMSE (normalized to 1) and the fraction of different pixels.
+    """
+    with tempfile.TemporaryDirectory() as tmpdir:
+        w1, h1, rgb1 = read_image(path1, dpi, workdir or tmpdir)
+        w2, h2, rgb2 = read_image(path2, dpi, workdir or tmpdir)
+
+    result = {"file1": path1, "file2": path2, "width": w1, "height": h1}
+
+    if (w1, h1) != (w2, h2):
+        result.update({"rmse": 1.0, "diff_fraction": 1.0, "error": f"different sizes {w1}x{h1} and {w2}x{h2}"})
+        return result
+
+    sum2 = 0
+    ndiff = 0
+    for i in range(0, len(rgb1), 3):
+        d = (rgb1[i] - rgb2[i], rgb1[i + 1] - rgb2[i + 1], rgb1[i + 2] - rgb2[i + 2])
+        sum2 += d[0] * d[0] + d[1] * d[1] + d[2] * d[2]
+        if max(abs(d[0]), abs(d[1]), abs(d[2])) > tolerance:
+            ndiff += 1
+
+    result["rmse"] = math.sqrt(sum2 / max(len(rgb1), 1)) / 255.0
+    result["diff_fraction"] = ndiff / max(w1 * h1, 1)
+    return result
+
+
+# # # #
+def compare_references(dpi):
+    """Produce the example plots in a temporary directory and compare them with
+    the reference PDF files (tests/pdfs and tests/pdfs_palette).
+    """
+    results = []
+    with tempfile.TemporaryDirectory() as tmpdir:
+        for script, refdir in (("example.py", "pdfs"), ("example_palette.py", "pdfs_palette")):
+            subprocess.run([sys.executable, os.path.join(TESTS_DIR, script)], cwd=tmpdir, check=True)
+
+            for ref in sorted(glob.glob(os.path.join(TESTS_DIR, refdir, "*.pdf"))):
+                new = os.path.join(tmpdir, refdir, os.path.basename(ref))
+                if not os.path.exists(new):
+                    results.append({"file1": ref, "file2": new, "rmse": 1.0, "diff_fraction": 1.0,
+                                    "error": "file not produced"})
+                    continue
+                results.append(compare(ref, new, dpi, tmpdir))
+                results[-1]["file2"] = os.path.join(refdir, os.path.basename(ref)) + " (new)"
+    return results
+
+
+# # # #
+def compare_cpp_python(directory, dpi):
+    """Compare the plots produced by the C++ (*_C.png) and python (*.png) implementations."""
+    results = []
+    for cfile in sorted(glob.glob(os.path.join(directory, "*_C.png"))):
+        pyfile = cfile[: -len("_C.png")] + ".png"
+        if os.path.exists(pyfile):
+            results.append(compare(cfile, pyfile, dpi))
+    return results
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Pixel comparison of CMSStyle plots")
+    parser.add_argument("files", nargs="*", help="Pair of files to compare")
+    parser.add_argument("--references", action="store_true",
+                        help="Produce the examples and compare them with the reference PDF files")
+    parser.add_argument("--cpp-python", metavar="DIR", help="Compare the *_C.png and *.png files in DIR")
+    parser.add_argument("--dpi", type=int, default=72, help="Resolution used to rasterize the PDF files")
+    parser.add_argument("--threshold", type=float, default=0.02, help="Maximum RMSE (normalized to 1) accepted")
+    parser.add_argument("--output", default="pixel_compare.json", help="Output file (JSON format)")
+    args = parser.parse_args()
+
+    results = []
+    if len(args.files) == 2:
+        results.append(compare(args.files[0], args.files[1], args.dpi))
+    elif len(args.files) != 0:
+        parser.error("Two files are needed for the comparison")
+    if args.references:
+        results += compare_references(args.dpi)
+    if args.cpp_python:
+        results += compare_cpp_python(args.cpp_python, args.dpi)
+
+    nfailed = 0
+    for xres in results:
+        xres["ok"] = xres["rmse"] <= args.threshold and "error" not in xres
+        nfailed += 0 if xres["ok"] else 1
+        print(f"{'OK    ' if xres['ok'] else 'FAILED'} {xres['file1']} vs {xres['file2']}: "
+              f"RMSE={xres['rmse']:.4f} different pixels={100*xres['diff_fraction']:.2f}% {xres.get('error', '')}")
+
+    with open(args.output, "w") as out:
+        json.dump(results, out, indent=2)
+
+    print(f"Finished: {len(results)} comparisons, {nfailed} failed (see {args.output})")
+    sys.exit(1 if nfailed > 0 else 0)